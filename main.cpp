@@ -3,9 +3,11 @@
 #include "Struct.h"
 #include "Const.h"
 #include "./Func/Vector/Vector.h"
+#include "./Func/Vector/VectorExpr.h"
 #include "./Func/Matrix/Matrix.h"
 #include "./Func/Draw/Draw.h"
 #include "./Func/Hits/Hits.h"
+#include "./Func/Hits/Sweep.h"
 #include "imgui.h"
 
 const char kWindowTitle[] = "LE2A_11_フクダソウワ_MT3";
@@ -71,6 +73,9 @@ int WINAPI WinMain(HINSTANCE, HINSTANCE, LPSTR, int)
 	// 反発係数
 	float e = 0.8f;
 
+	// 1フレームで衝突を解決する回数の上限（跳ね返った後の残りの時間でまた当たることがある）
+	const int kMaxCollisionIterations = 4;
+
 
 
 	// ウィンドウの×ボタンが押されるまでループ
@@ -141,39 +146,63 @@ int WINAPI WinMain(HINSTANCE, HINSTANCE, LPSTR, int)
 		----------------*/
 
 		ball.velocity += ball.acceleration * deltaTime;
-		ball.position += ball.velocity * deltaTime;
 
-		// ボールの描画で使う球
-		Sphere sphere;
-		sphere.center = ball.position;
-		sphere.radius = ball.radius;
+		// 1フレームの移動を平面に当たる時刻で区切り、跳ね返ってから残りの時間を進める
+		// （移動してから重なりを調べると、速いボールは平面をすり抜ける）
+		float remainingTime = deltaTime;
 
-		// 平面と球の衝突応答
-		if (IsCollision(sphere, plane))
+		for (int iteration = 0; iteration < kMaxCollisionIterations && remainingTime > 0.0f; iteration++)
 		{
-			// 反射したベクトル
-			Vector3 reflected = Reflect(ball.velocity, plane.normal);
+			Vector3 movement = ball.velocity * remainingTime;
 
-			// 法線の射影ベクトル
-			Vector3 projectToNormal = Project(reflected, plane.normal);
+			// 平面と球の衝突応答（判定で求めた接触情報をそのまま使う）
+			Contact contact = Sweep(Sphere{ ball.position , ball.radius }, movement, plane);
 
-			// 弾が進む方向
-			Vector3 movingDirection = reflected - projectToNormal;
+			if (!contact.hit)
+			{
+				ball.position += movement;
+				break;
+			}
+
+			// 当たる時刻まで進め、始めからめり込んでいた分だけ平面の外に押し出す（時刻で当たったときは 0）
+			ball.position += movement * contact.t + contact.normal * contact.penetration;
+
+			// 平面に向かって動いているときだけ跳ね返す
+			if (Dot(ball.velocity, contact.normal) < 0.0f)
+			{
+				// 反射したベクトル
+				Vector3 reflected = Reflect(ball.velocity, contact.normal);
 
-			ball.velocity = projectToNormal * e + movingDirection;
+				// 法線の射影ベクトル
+				Vector3 projectToNormal = ProjectOntoUnit(reflected, contact.normal);
+
+				// 法線方向は反発係数を掛け、弾が進む方向（反射 - 法線の射影）はそのまま
+				// （式テンプレートで途中のベクトルを作らずに1回で計算する）
+				ball.velocity = Lazy(projectToNormal) * e + (Lazy(reflected) - projectToNormal);
+			}
+
+			remainingTime *= 1.0f - contact.t;
 		}
 
+		// ボールの描画で使う球
+		Sphere sphere;
+		sphere.center = ball.position;
+		sphere.radius = ball.radius;
+
 
 		/*-------------------
 			座標変換の行列
 		-------------------*/
 
 		// ビュー行列
-		Matrix4x4 viewMatrix = Inverse(MakeAffineMatrix({ 1.0f , 1.0f , 1.0f }, cameraRotate, cameraTranslate));
+		Matrix4x4 viewMatrix = MakeViewMatrix(cameraRotate, cameraTranslate);
 
 		// 透視投影行列
 		Matrix4x4 projectionMatrix = MakePerspectiveFovMatrix(0.45f, static_cast<float>(kWindowWidth) / static_cast<float>(kWindowHeight), 0.1f, 100.0f);
 
+		// ビュー * 透視投影 行列（描画ごとに掛け直さないよう、1回だけ計算する）
+		Matrix4x4 viewProjectionMatrix = Multiply(viewMatrix, projectionMatrix);
+
 		// ビューポート行列
 		Matrix4x4 viewportMatrix = MakeViewportMatrix(0.0f, 0.0f, static_cast<float>(kWindowWidth), static_cast<float>(kWindowHeight), 0.0f, 1.0f);
 
@@ -187,13 +216,13 @@ int WINAPI WinMain(HINSTANCE, HINSTANCE, LPSTR, int)
 		///
 
 		// グリッド
-		DrawGrid(Multiply(viewMatrix, projectionMatrix), viewportMatrix);
+		DrawGrid(viewProjectionMatrix, viewportMatrix);
 
 		// 平面
-		DrawPlane(plane, Multiply(viewMatrix, projectionMatrix), viewportMatrix, 0xFFFFFFFF);
+		DrawPlane(plane, viewProjectionMatrix, viewportMatrix, 0xFFFFFFFF);
 
 		// ボール
-		DrawSphere(sphere, Multiply(viewMatrix, projectionMatrix), viewportMatrix, ball.color);
+		DrawSphere(sphere, viewProjectionMatrix, viewportMatrix, ball.color);
 
 
 		///